@@ -0,0 +1,58 @@
+#!/bin/bash
+# This file is part of NIT ( http://www.nitlanguage.org ).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compare the implementations of hash maps and sets
+
+source ./bench_common.sh
+source ./bench_plot.sh
+
+# Default number of times a command must be run with bench_command
+# Can be overrided with 'the option -n'
+count=2
+
+function usage()
+{
+	echo "run_bench: [options]* [keys loops]"
+	echo "  -v: verbose mode"
+	echo "  -n count: number of execution for each bar (default: $count)"
+	echo "  -h: this help"
+}
+
+stop=false
+while [ "$stop" = false ]; do
+	case "$1" in
+		-v) verbose=true; shift;;
+		-h) usage; exit;;
+		-n) count="$2"; shift; shift;;
+		*) stop=true
+	esac
+done
+
+keys=${1:-100000}
+loops=${2:-10}
+
+../bin/nitc --semi-global collections/hash_bench.nit -o hash_bench.bin || exit 1
+
+for collection in map set; do
+	prepare_res "hash_$collection.dat" "$collection" "standard Hash${collection}"
+	for kind in int string object; do
+		bench_command "$kind" "$kind keys" ./hash_bench.bin -m $collection -k $kind --keys $keys --loops $loops
+	done
+	prepare_res "open_hash_$collection.dat" "open_$collection" "open addressing"
+	for kind in int string object; do
+		bench_command "$kind" "$kind keys" ./hash_bench.bin -m open_$collection -k $kind --keys $keys --loops $loops
+	done
+	plot "hash_$collection.gnu"
+done
@@ -0,0 +1,40 @@
+#!/bin/bash
+# This file is part of NIT ( http://www.nitlanguage.org ).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Time and table sizes of the coloring of synthetic class hierarchies
+
+sizes="1000 5000 10000"
+
+function usage()
+{
+	echo "run_bench: [options]* [classes]*"
+	echo "  -h: this help"
+	echo "Numbers of classes default to: $sizes"
+}
+
+stop=false
+while [ "$stop" = false ]; do
+	case "$1" in
+		-h) usage; exit;;
+		*) stop=true
+	esac
+done
+
+../bin/nitc -I ../src/compiler coloring/coloring_bench.nit -o coloring_bench.bin || exit 1
+
+for n in ${@:-$sizes}; do
+	echo "## $n classes"
+	./coloring_bench.bin --classes "$n"
+done | tee coloring_bench.dat
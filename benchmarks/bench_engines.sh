@@ -331,6 +331,24 @@ function bench_compilation_time
 }
 bench_compilation_time
 
+# Rebuild nitc after small changes in a leaf module.
+# Only the C files whose content changed should be recompiled.
+function bench_incremental_compilation
+{
+	name="$FUNCNAME"
+	skip_test "$name" && return
+	local opts="--separate ../src/nitc.nit -o nitc_inc.bin --compile-dir .nit_compile_inc -I ../src -m leaf.nit"
+	printf "import toolcontext\nredef class ToolContext\n\tfun bench_leaf: Int do return 1\nend\n" > leaf.nit
+	prepare_res "$name-nitc-s.dat" "nitc-s" "nitc --separate, rebuild of nitc"
+	run_command ./nitc $opts
+	bench_command "nochange" "no change" ./nitc $opts
+	bench_command "touch" "touch a leaf module" sh -c "touch leaf.nit && ./nitc $opts"
+	bench_command "edit" "change a method body in a leaf module" sh -c "sed -i 's/return \([0-9]*\)/return 1\1/' leaf.nit && ./nitc $opts"
+	plot "$name.gnu"
+	rm -r leaf.nit nitc_inc.bin .nit_compile_inc
+}
+bench_incremental_compilation
+
 if test -n "$html"; then
 	echo >>"$html" "</body></html>"
 fi
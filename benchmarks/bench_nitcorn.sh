@@ -0,0 +1,51 @@
+#!/bin/bash
+# This file is part of NIT ( http://www.nitlanguage.org ).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Throughput and latency of a nitcorn server under a local load generator
+#
+# Usage: bench_nitcorn.sh [requests [port [threads]]]
+
+requests=${1:-10000}
+port=${2:-8081}
+threads=${3:-`getconf _NPROCESSORS_ONLN`}
+
+mkdir -p nitcorn/bin
+../bin/nitc --semi-global nitcorn/bench_server.nit -o nitcorn/bin/bench_server || exit 1
+../bin/nitc --semi-global nitcorn/http_load.nit -o nitcorn/bin/http_load || exit 1
+
+nitcorn/bin/bench_server $port &
+server=$!
+trap 'kill $server' EXIT
+sleep 1
+
+echo "*** New connection for each request ***"
+nitcorn/bin/http_load -n $requests --close localhost $port
+echo "*** Persistent connection ***"
+nitcorn/bin/http_load -n $requests localhost $port
+echo "*** Persistent connection, 16 pipelined requests ***"
+nitcorn/bin/http_load -n $requests --pipeline 16 localhost $port
+kill $server
+wait $server 2>/dev/null
+
+# One client per thread, each on its own persistent connection
+nitcorn/bin/bench_server $port $threads &
+server=$!
+sleep 1
+
+echo "*** $threads threads, $threads clients ***"
+for i in `seq 1 $threads`; do
+	nitcorn/bin/http_load -n $requests localhost $port &
+done
+wait `jobs -p | grep -v "^$server$"`
@@ -0,0 +1,39 @@
+#!/bin/bash
+# This file is part of NIT ( http://www.nitlanguage.org ).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Throughput of the lexer and the parser of the Nit tools, in MB/s
+
+loops=3
+
+function usage()
+{
+	echo "run_bench: [options]* [file|dir]*"
+	echo "  -n count: number of times each file is processed (default: $loops)"
+	echo "  -h: this help"
+	echo "Files and directories default to ../lib"
+}
+
+stop=false
+while [ "$stop" = false ]; do
+	case "$1" in
+		-h) usage; exit;;
+		-n) loops="$2"; shift; shift;;
+		*) stop=true
+	esac
+done
+
+../bin/nitc -I ../src parser/parser_bench.nit -o parser_bench.bin || exit 1
+
+./parser_bench.bin -n "$loops" "${@:-../lib}" | tee parser_bench.dat
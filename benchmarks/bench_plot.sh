@@ -78,6 +78,7 @@ function prepare_res()
 
 # Plot the last $res as an histogram
 # $1: plot file (eg toto.gnu)
+# $2: label of the y axis (default: time)
 function plot()
 {
 	cat >"$1" <<END
@@ -91,7 +92,7 @@ set bars front;
 set boxwidth 0.9;
 set xtic nomirror rotate by -45 scale 0 font ',8';
 set title "$1 ; avg. on $count-1 runs"
-set ylabel "time (s)"
+set ylabel "${2:-time (s)}"
 $plots
 END
 plots=
@@ -38,6 +38,8 @@ function usage()
 	echo "    - usage : substr max_nb_cct loops strlen"
 	echo "  array: Benchmark for the to_s in array"
 	echo "    - usage : array nb_cct loops max_arrlen"
+	echo "  ropes: time and peak memory of ropes, FlatBuffer and RopeBuffer on long chains of concatenations"
+	echo "    - usage : ropes max_nb_cct_in_thousands loops strlen"
 }
 
 function benches()
@@ -148,6 +150,95 @@ function bench_array()
 	plot array_tos.gnu
 }
 
+# Like `bench_command` but store the peak memory usage (maximum resident set size in KB)
+#
+#  $1: title of the command
+#  $2: long desription of the command
+#  rest: the command to execute
+function bench_memory()
+{
+	if [ "$dry_run" = "true" ]; then return; fi
+	local title="$1"
+	local desc="$2"
+	shift
+	shift
+	memout="mem.out"
+	echo "$title" > "$memout"
+	echo "# $desc" >> "$memout"
+	echo "\$ $@" >> "$memout"
+	echo
+	echo "** [$title] $desc (memory) **"
+	echo " $ $@"
+
+	for i in `seq 1 "$count"`; do
+		/usr/bin/time -f "%M" -o "$memout" -a "$@" > /dev/null 2>&1 || die "$1: failed"
+		echo -n "$i. "
+		tail -n 1 "$memout"
+	done
+
+	line=`compute_stats "$memout"`
+	echo "$line ($res)"
+	echo $line >> "$res"
+}
+
+# Bench the strings built by long chains of concatenations
+#
+# `String` concatenations build ropes: the concatenations, substrings and
+# iterations are measured in time and peak memory against `FlatBuffer`
+# and `RopeBuffer` on the same strings.
+function bench_ropes()
+{
+	if $verbose; then
+		echo "*** Benching ropes ***"
+	fi
+
+	../bin/nitc --global ./strings/chain_concat.nit --make-flags "CFLAGS=\"-g -O2 -DNOBOEHM\""
+	../bin/nitc --global ./strings/substr_bench.nit --make-flags "CFLAGS=\"-g -O2 -DNOBOEHM\""
+	../bin/nitc --global ./strings/iteration_bench.nit --make-flags "CFLAGS=\"-g -O2 -DNOBOEHM\""
+
+	# The peak memory is only meaningful when the garbage is collected,
+	# the memory runs use their own binaries with the default flags and the GC.
+	../bin/nitc --global ./strings/chain_concat.nit -o chain_concat_gc
+	../bin/nitc --global ./strings/substr_bench.nit -o substr_bench_gc
+	../bin/nitc --global ./strings/iteration_bench.nit -o iteration_bench_gc
+
+	for measure in command memory; do
+		if [ "$measure" = "command" ]; then
+			label="time (s)"
+			run=""
+			bin=""
+		else
+			label="peak memory (KB)"
+			run="env NIT_GC_OPTION=boehm"
+			bin="_gc"
+		fi
+
+		for mode in flatstr flatbuf ropebuf; do
+			prepare_res ropes_cct_$mode.$measure.out ropes_cct_$mode $mode
+			for i in `seq 1 "$1"`; do
+				bench_$measure ${i}k cct_$mode$i $run ./chain_concat$bin -m $mode --loops $2 --strlen $3 --ccts ${i}000
+			done
+		done
+		plot ropes_cct_$measure.gnu "$label"
+
+		for mode in flatstr flatbuf ropebuf; do
+			prepare_res ropes_substr_$mode.$measure.out ropes_substr_$mode $mode
+			for i in `seq 1 "$1"`; do
+				bench_$measure ${i}k substr_$mode$i $run ./substr_bench$bin -m $mode --loops $2 --strlen $3 --ccts ${i}000
+			done
+		done
+		plot ropes_substr_$measure.gnu "$label"
+
+		for mode in flatstr flatbuf ropebuf; do
+			prepare_res ropes_index_$mode.$measure.out ropes_index_$mode $mode
+			for i in `seq 1 "$1"`; do
+				bench_$measure ${i}k index_$mode$i $run ./iteration_bench$bin -m $mode --iter-mode index --loops $2 --strlen $3 --ccts ${i}000
+			done
+		done
+		plot ropes_index_$measure.gnu "$label"
+	done
+}
+
 function bench_concat()
 {
 	../bin/nitc --global ./strings/chain_concat.nit --make-flags "CFLAGS=\"-g -O2 -DNOBOEHM\""
@@ -448,6 +539,7 @@ case "$1" in
 	cct) shift; bench_concat $@ ;;
 	substr) shift; bench_substr $@ ;;
 	array) shift; bench_array $@ ;;
+	ropes) shift; bench_ropes $@ ;;
 	all) shift; benches $@ ;;
 	*) usage; exit;;
 esac
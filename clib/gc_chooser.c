@@ -40,6 +40,21 @@ void *nit_raw_alloc(size_t s0)
 	}
 }
 
+#ifdef NIT_TLAB
+__thread struct nit_tlab nit_tlab;
+
+/* Slow path of the `large` option: get a new thread-local buffer.
+ * The remaining of the previous buffer is lost. */
+static void *large_alloc(size_t s0)
+{
+	size_t s = NIT_ALLOC_SIZE(s0);
+	size_t alloc_size = s + 1024*1024;
+	char *res = (char *)calloc(alloc_size, 1);
+	nit_tlab.pos = res + s;
+	nit_tlab.end = res + alloc_size;
+	return res;
+}
+#else
 static void *large_alloc(size_t s0)
 {
 	static char * alloc_pos = NULL;
@@ -55,6 +70,7 @@ static void *large_alloc(size_t s0)
 	alloc_pos += s;
 	return res;
 }
+#endif
 
 void nit_gcollect(void) {
 	switch (gc_option) {
@@ -64,7 +80,11 @@ void nit_gcollect(void) {
 	}
 }
 
+#ifdef NIT_TLAB
+void *nit_alloc_slow(size_t s0)
+#else
 void *nit_alloc(size_t s0)
+#endif
 {
 	switch (gc_option) {
 #ifdef WITH_LIBGC
@@ -15,8 +15,35 @@
 #include <stdio.h>
 
 /* GC and memory management */
-void *nit_alloc(size_t); /* allocate memory to store an object with an object header */
 void *nit_raw_alloc(size_t); /* allocate raw memory to store a raw stram of byte */
+
+#ifdef NIT_TLAB
+/* Thread-local allocation buffer, enabled by `nitc --tlab`.
+ * Used by the `large` GC option to allocate with a simple bump of pointer,
+ * without any lock. It is always empty with the other GC options. */
+struct nit_tlab { char *pos; char *end; };
+extern __thread struct nit_tlab nit_tlab;
+
+/* Size of an allocation, rounded to keep the allocated memory aligned on pointers */
+#define NIT_ALLOC_SIZE(s) (((s) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
+void *nit_alloc_slow(size_t); /* allocate memory when the thread-local buffer cannot be used */
+
+/* allocate memory to store an object with an object header */
+static inline void *nit_alloc(size_t s0)
+{
+	size_t s = NIT_ALLOC_SIZE(s0);
+	char *res = nit_tlab.pos;
+	if (s < (size_t)(nit_tlab.end - res)) {
+		nit_tlab.pos = res + s;
+		return res;
+	}
+	return nit_alloc_slow(s0);
+}
+#else
+void *nit_alloc(size_t); /* allocate memory to store an object with an object header */
+#endif
+
 void nit_gcollect(void); /* force a garbage collection */
 void initialize_gc_option(void); /* Select the wanted GC using envvar `NIT_GC_OPTION` */
 
@@ -23,4 +23,36 @@ extern const int* const parser_goto_table[];
 #define parser_action(o,i,j) (parser_action_table[(i)][(j)])
 #define parser_goto(o,i,j) (parser_goto_table[(i)][(j)])
 
+/* Resolved transitions of the lexer on ASCII characters, one row per state.
+ * Rows are built at the first use by `lexer_build_ascii_row`. */
+extern const int** lexer_ascii_rows;
+const int* lexer_build_ascii_row(int state);
+
+#define lexer_ascii_goto(o,i,j) ((lexer_ascii_rows != NULL && lexer_ascii_rows[(i)] != NULL ? lexer_ascii_rows[(i)] : lexer_build_ascii_row((i)))[(j)])
+
+/* A comb-compressed table.
+ * The value of `key` in `row` is `value[base[row]+key]` if `check` at the
+ * same index is `row`, else it is `defaults[row]`. */
+struct comb_table {
+	int *base;
+	int *check;
+	int *value;
+	int *defaults;
+	int size;
+};
+
+extern struct comb_table parser_action_comb;
+extern struct comb_table parser_goto_comb;
+void parser_build_combs(void);
+
+static inline int comb_get(const struct comb_table *t, int row, int key) {
+	int i = t->base[row] + key;
+	if (i < t->size && t->check[i] == row) return t->value[i];
+	return t->defaults[row];
+}
+
+#define parser_init_combs(o) (parser_action_comb.base == NULL ? parser_build_combs() : (void)0)
+#define parser_comb_action(o,i,j) comb_get(&parser_action_comb, (i), (j))
+#define parser_comb_goto(o,i,j) comb_get(&parser_goto_comb, (i), (j))
+
 #endif
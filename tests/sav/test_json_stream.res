@@ -0,0 +1,36 @@
+# [1, -2.5e1, "a\"b\u0041", true, false, null, {"x": [], "y": {}}]
+[1,-25.0,"a\"bA",true,false,null,{"x":[],"y":{}}] ok
+1: [1,-25.0,"a\"bA",true,false,null,{"x":[],"y":{}}] ok
+2: [1,-25.0,"a\"bA",true,false,null,{"x":[],"y":{}}] ok
+3: [1,-25.0,"a\"bA",true,false,null,{"x":[],"y":{}}] ok
+7: [1,-25.0,"a\"bA",true,false,null,{"x":[],"y":{}}] ok
+#  {"foo" : "bar" , "n" : [ 12345678, 0.125 ] }  
+{"foo":"bar","n":[12345678,0.125]} ok
+1: {"foo":"bar","n":[12345678,0.125]} ok
+2: {"foo":"bar","n":[12345678,0.125]} ok
+3: {"foo":"bar","n":[12345678,0.125]} ok
+7: {"foo":"bar","n":[12345678,0.125]} ok
+# [1, 2 3]
+[1,2] [1:7-1:7] Unexpected character '3'; is acceptable instead: ',', '}' or ']'
+1: [1,2] [1:7-1:7] Unexpected character '3'; is acceptable instead: ',', '}' or ']'
+2: [1,2] [1:7-1:7] Unexpected character '3'; is acceptable instead: ',', '}' or ']'
+3: [1,2] [1:7-1:7] Unexpected character '3'; is acceptable instead: ',', '}' or ']'
+7: [1,2] [1:7-1:7] Unexpected character '3'; is acceptable instead: ',', '}' or ']'
+# {"a": "unterminated
+{"a":""} [1:20-1:20] Unexpected end of file; is acceptable instead: '"'
+1: {"a":""} [1:20-1:20] Unexpected end of file; is acceptable instead: '"'
+2: {"a":""} [1:20-1:20] Unexpected end of file; is acceptable instead: '"'
+3: {"a":""} [1:20-1:20] Unexpected end of file; is acceptable instead: '"'
+7: {"a":""} [1:20-1:20] Unexpected end of file; is acceptable instead: '"'
+# [1, tru]
+[1,false] [1:5-1:5] Unexpected character 't'; is acceptable instead: 'true' or 'false'
+1: [1,false] [1:5-1:5] Unexpected character 't'; is acceptable instead: 'true' or 'false'
+2: [1,false] [1:5-1:5] Unexpected character 't'; is acceptable instead: 'true' or 'false'
+3: [1,false] [1:5-1:5] Unexpected character 't'; is acceptable instead: 'true' or 'false'
+7: [1,false] [1:5-1:5] Unexpected character 't'; is acceptable instead: 'true' or 'false'
+<A: 1 one [<A: 2 two []>, <A: 2 two []>, c, ]>
+<A: 1 one [<A: 2 two []>, <A: 2 two []>, c, ]>
+<A: 1 one [<A: 2 two []>, <A: 2 two []>, c, ]>
+<A: 1 one [<A: 2 two []>, c, 1.5]>
+<A: 1 one [<A: 2 two []>, c, 1.5]>
+[1:6-1:6] Unexpected end of file; is acceptable instead: ',', '}' or ']'
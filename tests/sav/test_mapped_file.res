@@ -0,0 +1,12 @@
+true
+# This file is part of NIT ( http://www.nitlanguage.org ).
+63
+#
+false
+This file is part of NIT ( 
+false
+true
+true
+hello World
+Hello World
+0
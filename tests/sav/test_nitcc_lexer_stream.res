@@ -0,0 +1,43 @@
+tokens of "{\"a\": [1, true]}":
+  '{'@(1:1-1:2)
+  string@(1:2-1:5)='\"a\"'
+  ':'@(1:5-1:6)
+  '['@(1:7-1:8)
+  number@(1:8-1:9)='1'
+  ','@(1:9-1:10)
+  'true'@(1:11-1:15)
+  ']'@(1:15-1:16)
+  '}'@(1:16-1:17)
+  Eof@(1:17-1:17)=''
+tokens of "[1,\n 2]  ":
+  '['@(1:1-1:2)
+  number@(1:2-1:3)='1'
+  ','@(1:3-1:4)
+  number@(2:2-2:3)='2'
+  ']'@(2:3-2:4)
+  Eof@(2:6-2:6)=''
+tokens of "[1, @]":
+  '['@(1:1-1:2)
+  number@(1:2-1:3)='1'
+  ','@(1:3-1:4)
+  NLexerError@(1:5-1:5)='@'
+tokens of "":
+  Eof@(1:1-1:1)=''
+parse "{\"a\": [1, true]}": Start
+  then Eof@(1:17-1:17)=''
+parse "[1,\n 2]  ": Start
+  then Eof@(2:6-2:6)=''
+parse "[1, @]": 1:5-1:5 Unexpected character '@'; is acceptable instead: value
+  then NLexerError@(1:5-1:5)='@'
+parse "[1 2]": 1:4-1:5 Unexpected number '2'; is acceptable instead: ']', ','
+  then ']'@(1:5-1:6)
+parse "": 1:1-1:1 Unexpected Eof; is acceptable instead: value
+  then Eof@(1:1-1:1)=''
+tokens of "[\"é\"]":
+  '['@(1:1-1:2)
+  string@(1:2-1:6)='\"é\"'
+  ']'@(1:6-1:7)
+  Eof@(1:7-1:7)=''
+1:2-1:4 12
+6
+345
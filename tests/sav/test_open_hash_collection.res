@@ -0,0 +1,65 @@
+* test 1 *
+2 - 4
+20 - 4
+true
+true
+true
+true
+true
+true
+2
+0
+* test 2 *
+1000
+334
+* test 3 *
+* start:
+true
+true
+true
+true
+true
+true
+true
+true
+true
+* add some:
+true
+true
+true
+true
+true
+true
+true
+true
+true
+true
+bleu, rouge, rose, jaune, orange, noir, gris, gris, blanc
+* remove:
+true
+true
+true
+true
+true
+true
+true
+rouge, jaune, orange, noir, blanc
+true
+* set *
+1000
+250
+true
+false
+true
+1241
+0
+1241
+true
+5263
+0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19
+true
+false
+* add/remove *
+1
+true
+1
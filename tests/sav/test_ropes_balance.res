@@ -0,0 +1,5 @@
+append: length=8661 same=true balanced=true shallow=true
+prepend: length=8661 same=true balanced=true shallow=true
+mix: length=13706 same=true balanced=true shallow=true
+substring: length=3000 same=true balanced=true shallow=true
+reversed: length=8661 same=true balanced=true shallow=true
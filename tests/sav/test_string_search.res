@@ -25,3 +25,54 @@ splits:
 * " exam"
 * ""
 join: A sim,  exam, 
+string: "A simple example" ; pattern: "ex|simple|imp|ample|A s"
+searches:
+* [0, 3[ = "A s"
+* [3, 6[ = "imp"
+* [9, 11[ = "ex"
+* [11, 16[ = "ample"
+splits:
+* ""
+* ""
+* "le "
+* ""
+* ""
+join: , , le , , 
+string: "r simple example" ; pattern: "e"
+searches:
+* [7, 8[ = "e"
+* [9, 10[ = "e"
+* [15, 16[ = "e"
+splits:
+* "r simpl"
+* " "
+* "xampl"
+* ""
+join: r simpl,  , xampl, 
+string: "r simple example" ; pattern: "mp"
+searches:
+* [4, 6[ = "mp"
+* [12, 14[ = "mp"
+splits:
+* "r si"
+* "le exa"
+* "le"
+join: r si, le exa, le
+string: "r simple example" ; pattern: "mp|e e"
+searches:
+* [4, 6[ = "mp"
+* [7, 10[ = "e e"
+* [12, 14[ = "mp"
+splits:
+* "r si"
+* "l"
+* "xa"
+* "le"
+join: r si, l, xa, le
+4
+5
+10
+12
+true
+false
+2